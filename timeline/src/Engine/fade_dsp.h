@@ -0,0 +1,50 @@
+
+/*******************************************************************************/
+/* Copyright (C) 2008-2021 Jonathan Moore Liles (as "Non-Timeline")            */
+/* Copyright (C) 2023- Stazed                                                  */
+/*                                                                             */
+/* This file is part of Non-Timeline-XT                                        */
+/*                                                                             */
+/*                                                                             */
+/* This program is free software; you can redistribute it and/or modify it     */
+/* under the terms of the GNU General Public License as published by the       */
+/* Free Software Foundation; either version 2 of the License, or (at your      */
+/* option) any later version.                                                  */
+/*                                                                             */
+/* This program is distributed in the hope that it will be useful, but WITHOUT */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   */
+/* more details.                                                               */
+/*                                                                             */
+/* You should have received a copy of the GNU General Public License along     */
+/* with This program; see the file COPYING.  If not,write to the Free Software */
+/* Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  */
+/*******************************************************************************/
+
+
+#pragma once
+
+/* gain and fade kernel for playing regions */
+
+#include "types.h"
+
+/* resolution of the tables the fade curves are looked up in. Each
+ * table has FADE_TABLE_SIZE + 2 entries, so that lookups may
+ * interpolate right up to the end of the curve */
+#define FADE_TABLE_SIZE 1024
+
+/* fades which can be active at once: fade in and out, and declicks on
+ * either side of two loop seams */
+#define MAX_RAMPS 6
+
+/* the part of a fade which falls within a block */
+struct fade_ramp
+{
+    nframes_t first;                                            /* first frame of the block faded */
+    nframes_t last;                                             /* one past the last */
+    const float *table;
+    double fi;                                                  /* position on the curve at /first/ */
+    double inc;
+};
+
+void fade_apply_gain ( sample_t *buf, int channels, nframes_t nframes, float scale, const fade_ramp *ramps, int nramps );
@@ -0,0 +1,34 @@
+
+/*******************************************************************************/
+/* Copyright (C) 2008-2021 Jonathan Moore Liles (as "Non-Timeline")            */
+/* Copyright (C) 2023- Stazed                                                  */
+/*                                                                             */
+/* This file is part of Non-Timeline-XT                                        */
+/*                                                                             */
+/*                                                                             */
+/* This program is free software; you can redistribute it and/or modify it     */
+/* under the terms of the GNU General Public License as published by the       */
+/* Free Software Foundation; either version 2 of the License, or (at your      */
+/* option) any later version.                                                  */
+/*                                                                             */
+/* This program is distributed in the hope that it will be useful, but WITHOUT */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   */
+/* more details.                                                               */
+/*                                                                             */
+/* You should have received a copy of the GNU General Public License along     */
+/* with This program; see the file COPYING.  If not,write to the Free Software */
+/* Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  */
+/*******************************************************************************/
+
+#pragma once
+
+/* min/max reduction kernels for building and resampling peaks */
+
+#include "types.h"
+#include "Peak.H"
+
+void peak_accumulate_samples ( Peak *peaks, const sample_t *buf, int channels, nframes_t nframes );
+void peak_accumulate_peaks ( Peak *peaks, const Peak *buf, int channels, nframes_t nframes );
+
+const char *peak_dsp_implementation ( void );